@@ -0,0 +1,163 @@
+#include "AsyncIO.h"
+
+// konstruktor kolejki alokuje tablice cykliczna
+BlockQueue::BlockQueue(int cap) : capacity(cap), head(0), count(0), closed(false) {
+    items = new DataBlock*[capacity];
+}
+
+// destruktor zwalnia tablice same bloki nalezy do czytnika lub pisarza
+BlockQueue::~BlockQueue() {
+    delete[] items;
+}
+
+bool BlockQueue::push(DataBlock* block) {
+    std::unique_lock<std::mutex> lock(mtx);
+    // czekamy az zwolni sie miejsce albo ktos zamknie kolejke
+    notFull.wait(lock, [this] { return count < capacity || closed; });
+    if (closed) return false;
+    items[(head + count) % capacity] = block; // wstawiamy na koniec
+    count++;
+    notEmpty.notify_one(); // budzimy watek ktory czeka na dane
+    return true;
+}
+
+DataBlock* BlockQueue::pop() {
+    std::unique_lock<std::mutex> lock(mtx);
+    // czekamy az cos przyjdzie albo kolejka zostanie zamknieta
+    notEmpty.wait(lock, [this] { return count > 0 || closed; });
+    // po zamknieciu oddajemy jeszcze to co zostalo w kolejce
+    if (count == 0) return nullptr;
+    DataBlock* block = items[head]; // bierzemy z poczatku
+    head = (head + 1) % capacity;
+    count--;
+    notFull.notify_one(); // budzimy watek ktory czeka na miejsce
+    return block;
+}
+
+void BlockQueue::close() {
+    std::lock_guard<std::mutex> lock(mtx);
+    closed = true;
+    notEmpty.notify_all();
+    notFull.notify_all();
+}
+
+// czytnik na start wrzuca wszystkie bufory jako puste i odpala watek
+AsyncReader::AsyncReader(std::ifstream& stream)
+    : in(stream), freeBlocks(IO_BLOCK_COUNT), fullBlocks(IO_BLOCK_COUNT), current(nullptr), pos(0) {
+    for (int i = 0; i < IO_BLOCK_COUNT; i++) {
+        blocks[i].data = new unsigned char[IO_BLOCK_SIZE];
+        blocks[i].size = 0;
+        freeBlocks.push(&blocks[i]);
+    }
+    worker = std::thread(&AsyncReader::readLoop, this);
+}
+
+// destruktor zamyka kolejki zeby watek nie czekal w nieskonczonosc
+// np jak dekoder przerwal prace w polowie pliku
+AsyncReader::~AsyncReader() {
+    freeBlocks.close();
+    fullBlocks.close();
+    worker.join();
+    for (int i = 0; i < IO_BLOCK_COUNT; i++) {
+        delete[] blocks[i].data;
+    }
+}
+
+void AsyncReader::readLoop() {
+    while (true) {
+        DataBlock* block = freeBlocks.pop(); // czekamy na pusty bufor
+        if (!block) break; // kolejka zamknieta czyli konczymy
+        in.read(reinterpret_cast<char*>(block->data), IO_BLOCK_SIZE);
+        block->size = (int)in.gcount(); // ile faktycznie przeczytano
+        if (block->size == 0) break; // koniec pliku
+        if (!fullBlocks.push(block)) break; // oddajemy koderowi
+        if (!in) break; // byl niepelny odczyt czyli to byl ostatni blok
+    }
+    // zamykamy kolejke zeby koder wiedzial ze wiecej danych nie bedzie
+    fullBlocks.close();
+}
+
+bool AsyncReader::nextBlock() {
+    // oddajemy przetworzony blok z powrotem do watku czytajacego
+    if (current) freeBlocks.push(current);
+    current = fullBlocks.pop();
+    pos = 0;
+    return current != nullptr;
+}
+
+int AsyncReader::read(unsigned char* dst, int n) {
+    int done = 0;
+    while (done < n) {
+        if (!current || pos == current->size) {
+            if (!nextBlock()) break; // koniec danych
+        }
+        // kopiujemy tyle ile jest w bloku albo ile jeszcze brakuje
+        int chunk = current->size - pos;
+        if (chunk > n - done) chunk = n - done;
+        std::memcpy(dst + done, current->data + pos, chunk);
+        pos += chunk;
+        done += chunk;
+    }
+    return done;
+}
+
+// pisarz zaczyna od pierwszego bufora a reszte trzyma jako wolne
+AsyncWriter::AsyncWriter(std::ofstream& stream)
+    : out(stream), freeBlocks(IO_BLOCK_COUNT), fullBlocks(IO_BLOCK_COUNT), current(nullptr),
+      failed(false), finished(false) {
+    for (int i = 0; i < IO_BLOCK_COUNT; i++) {
+        blocks[i].data = new unsigned char[IO_BLOCK_SIZE];
+        blocks[i].size = 0;
+        if (i > 0) freeBlocks.push(&blocks[i]);
+    }
+    current = &blocks[0];
+    worker = std::thread(&AsyncWriter::writeLoop, this);
+}
+
+AsyncWriter::~AsyncWriter() {
+    finish(); // jak ktos zapomnial to dopisujemy reszte
+    for (int i = 0; i < IO_BLOCK_COUNT; i++) {
+        delete[] blocks[i].data;
+    }
+}
+
+void AsyncWriter::writeLoop() {
+    while (true) {
+        DataBlock* block = fullBlocks.pop(); // czekamy na pelny bufor
+        if (!block) break; // kolejka zamknieta i pusta czyli koniec
+        out.write(reinterpret_cast<const char*>(block->data), block->size);
+        if (!out) failed = true; // zapamietujemy blad zapisu
+        block->size = 0;
+        freeBlocks.push(block); // oddajemy pusty bufor koderowi
+    }
+}
+
+void AsyncWriter::nextBlock() {
+    fullBlocks.push(current); // pelny blok idzie do zapisu
+    current = freeBlocks.pop(); // i czekamy na pusty
+}
+
+void AsyncWriter::write(const unsigned char* src, int n) {
+    int done = 0;
+    while (done < n) {
+        if (current->size == IO_BLOCK_SIZE) nextBlock();
+        // kopiujemy ile sie zmiesci w aktualnym bloku
+        int chunk = IO_BLOCK_SIZE - current->size;
+        if (chunk > n - done) chunk = n - done;
+        std::memcpy(current->data + current->size, src + done, chunk);
+        current->size += chunk;
+        done += chunk;
+    }
+}
+
+bool AsyncWriter::finish() {
+    if (finished) return !failed;
+    finished = true;
+    // wysylamy niepelny ostatni blok
+    if (current->size > 0) fullBlocks.push(current);
+    fullBlocks.close(); // watek zapisze co zostalo i sie zakonczy
+    worker.join();
+    out.flush();
+    if (!out) failed = true;
+    return !failed;
+}
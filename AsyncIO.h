@@ -0,0 +1,117 @@
+#ifndef ASYNC_IO_H
+#define ASYNC_IO_H
+
+#include <fstream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <cstring>
+
+// rozmiar jednego bloku danych przesylanego miedzy watkami
+const int IO_BLOCK_SIZE = 1 << 16;
+// ile blokow krazy w potoku 3 czyli potrojne buforowanie
+// jeden blok czyta dysk jeden przetwarza koder a jeden czeka w kolejce
+const int IO_BLOCK_COUNT = 3;
+
+// pojedynczy blok danych czyli bufor i ile jest w nim bajtow
+struct DataBlock {
+    unsigned char* data; // wlasciwe bajty
+    int size;            // ile bajtow jest zapelnionych
+};
+
+// ograniczona kolejka blokow miedzy dwoma watkami
+// zrobiona na tablicy cyklicznej zeby nie uzywac std queue
+// jak jest pelna to push czeka a jak pusta to pop czeka
+class BlockQueue {
+    DataBlock** items; // tablica cykliczna wskaznikow na bloki
+    int capacity;      // maksymalna liczba blokow w kolejce
+    int head;          // indeks pierwszego elementu
+    int count;         // ile jest teraz elementow
+    bool closed;       // czy kolejka zostala zamknieta
+    std::mutex mtx;                 // blokada chroniaca pola kolejki
+    std::condition_variable notEmpty; // sygnal ze cos przyszlo
+    std::condition_variable notFull;  // sygnal ze zwolnilo sie miejsce
+
+public:
+    BlockQueue(int cap);
+    ~BlockQueue();
+
+    // wrzuca blok do kolejki zwraca false jak kolejka zamknieta
+    bool push(DataBlock* block);
+    // pobiera blok z kolejki zwraca nullptr jak zamknieta i pusta
+    DataBlock* pop();
+    // zamyka kolejke i budzi wszystkie czekajace watki
+    void close();
+};
+
+// asynchroniczny czytnik pliku
+// osobny watek czyta bloki z dysku do przodu a koder w tym czasie liczy
+// dzieki temu czas to mniej wiecej max z czasu dysku i procesora a nie suma
+class AsyncReader {
+    std::ifstream& in;             // strumien z ktorego czyta watek
+    DataBlock blocks[IO_BLOCK_COUNT]; // pula buforow
+    BlockQueue freeBlocks;         // puste bufory czekajace na odczyt
+    BlockQueue fullBlocks;         // bufory z danymi dla kodera
+    DataBlock* current;            // blok ktory aktualnie przetwarzamy
+    int pos;                       // pozycja w aktualnym bloku
+    std::thread worker;            // watek czytajacy
+
+    // petla watku czytajacego
+    void readLoop();
+    // oddaje aktualny blok i bierze nastepny zwraca false na koncu pliku
+    bool nextBlock();
+
+public:
+    // strumien musi byc ustawiony na miejscu od ktorego chcemy czytac
+    AsyncReader(std::ifstream& stream);
+    ~AsyncReader();
+
+    // pobiera jeden bajt zwraca false jak koniec danych
+    bool get(unsigned char& c) {
+        if (!current || pos == current->size) {
+            if (!nextBlock()) return false;
+        }
+        c = current->data[pos++];
+        return true;
+    }
+
+    // czyta do n bajtow do tablicy dst zwraca ile faktycznie przeczytano
+    int read(unsigned char* dst, int n);
+};
+
+// asynchroniczny zapis do pliku
+// koder wypelnia blok a osobny watek zapisuje poprzednie na dysk
+class AsyncWriter {
+    std::ofstream& out;            // strumien do ktorego pisze watek
+    DataBlock blocks[IO_BLOCK_COUNT]; // pula buforow
+    BlockQueue freeBlocks;         // puste bufory dla kodera
+    BlockQueue fullBlocks;         // bufory czekajace na zapis
+    DataBlock* current;            // blok ktory aktualnie wypelniamy
+    bool failed;                   // czy zapis na dysk sie nie udal
+    bool finished;                 // czy finish juz byl wywolany
+    std::thread worker;            // watek zapisujacy
+
+    // petla watku zapisujacego
+    void writeLoop();
+    // wysyla pelny blok do zapisu i bierze pusty
+    void nextBlock();
+
+public:
+    // strumien musi byc otwarty i ustawiony tam gdzie maja trafic dane
+    AsyncWriter(std::ofstream& stream);
+    ~AsyncWriter();
+
+    // dopisuje jeden bajt
+    void put(unsigned char c) {
+        if (current->size == IO_BLOCK_SIZE) nextBlock();
+        current->data[current->size++] = c;
+    }
+
+    // dopisuje n bajtow z tablicy src
+    void write(const unsigned char* src, int n);
+
+    // wypycha reszte danych czeka na watek i zwraca czy zapis sie udal
+    bool finish();
+};
+
+#endif
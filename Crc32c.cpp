@@ -0,0 +1,109 @@
+#include "Crc32c.h"
+
+// sprzetowa wersja tylko dla gcc i clang na x86
+// inne kompilatory i procesory uzywaja wersji tablicowej
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define CRC32C_HW 1
+#include <nmmintrin.h>
+#include <cstring>
+#endif
+
+// odwrocony wielomian castagnoli
+const unsigned int CRC32C_POLY = 0x82F63B78u;
+
+// tablice do metody slicing by 8
+// kazdy krok petli przetwarza 8 bajtow zamiast jednego
+struct Crc32cTables {
+    unsigned int t[8][256];
+
+    Crc32cTables() {
+        // pierwsza tablica to zwykla tablica crc dla jednego bajtu
+        for (unsigned int i = 0; i < 256; i++) {
+            unsigned int crc = i;
+            for (int k = 0; k < 8; k++) {
+                crc = (crc & 1) ? (crc >> 1) ^ CRC32C_POLY : crc >> 1;
+            }
+            t[0][i] = crc;
+        }
+        // kolejne tablice to przesuniecie o nastepny bajt zer
+        for (int j = 1; j < 8; j++) {
+            for (int i = 0; i < 256; i++) {
+                t[j][i] = (t[j - 1][i] >> 8) ^ t[0][t[j - 1][i] & 0xFF];
+            }
+        }
+    }
+};
+
+// tablice budowane raz przy pierwszym uzyciu
+static const Crc32cTables& tables() {
+    static Crc32cTables instance;
+    return instance;
+}
+
+// wersja tablicowa dziala na kazdym procesorze
+static unsigned int crc32cSoftware(unsigned int crc, const unsigned char* p, long long len) {
+    const Crc32cTables& tb = tables();
+    // glowna petla po 8 bajtow
+    while (len >= 8) {
+        unsigned int lo = crc ^ ((unsigned int)p[0] | (unsigned int)p[1] << 8 |
+                                 (unsigned int)p[2] << 16 | (unsigned int)p[3] << 24);
+        crc = tb.t[7][lo & 0xFF] ^ tb.t[6][(lo >> 8) & 0xFF] ^
+              tb.t[5][(lo >> 16) & 0xFF] ^ tb.t[4][lo >> 24] ^
+              tb.t[3][p[4]] ^ tb.t[2][p[5]] ^ tb.t[1][p[6]] ^ tb.t[0][p[7]];
+        p += 8;
+        len -= 8;
+    }
+    // reszta bajt po bajcie
+    while (len-- > 0) {
+        crc = (crc >> 8) ^ tb.t[0][(crc ^ *p++) & 0xFF];
+    }
+    return crc;
+}
+
+#ifdef CRC32C_HW
+// wersja sprzetowa instrukcja crc32 z sse4.2
+// atrybut target pozwala skompilowac ja bez flagi -msse4.2 dla calego programu
+__attribute__((target("sse4.2")))
+static unsigned int crc32cSse42(unsigned int crc, const unsigned char* p, long long len) {
+#if defined(__x86_64__)
+    unsigned long long crc64 = crc;
+    while (len >= 8) {
+        unsigned long long word;
+        std::memcpy(&word, p, 8); // memcpy bo dane nie musza byc wyrownane
+        crc64 = _mm_crc32_u64(crc64, word);
+        p += 8;
+        len -= 8;
+    }
+    crc = (unsigned int)crc64;
+#endif
+    while (len >= 4) {
+        unsigned int word;
+        std::memcpy(&word, p, 4);
+        crc = _mm_crc32_u32(crc, word);
+        p += 4;
+        len -= 4;
+    }
+    while (len-- > 0) {
+        crc = _mm_crc32_u8(crc, *p++);
+    }
+    return crc;
+}
+#endif
+
+bool crc32cHardware() {
+#ifdef CRC32C_HW
+    // sprawdzamy raz czy procesor ma sse4.2
+    static const bool supported = __builtin_cpu_supports("sse4.2");
+    return supported;
+#else
+    return false;
+#endif
+}
+
+unsigned int crc32c(const unsigned char* data, long long len) {
+    unsigned int crc = 0xFFFFFFFFu; // wartosc poczatkowa
+#ifdef CRC32C_HW
+    if (crc32cHardware()) return crc32cSse42(crc, data, len) ^ 0xFFFFFFFFu;
+#endif
+    return crc32cSoftware(crc, data, len) ^ 0xFFFFFFFFu; // koncowa negacja
+}
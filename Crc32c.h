@@ -0,0 +1,13 @@
+#ifndef CRC32C_H
+#define CRC32C_H
+
+// suma kontrolna crc32c (wielomian castagnoli)
+// na procesorach z sse4.2 liczona instrukcja crc32 a bez tego z tablic
+
+// liczy sume kontrolna dla len bajtow z tablicy data
+unsigned int crc32c(const unsigned char* data, long long len);
+
+// zwraca true jesli uzywana jest sprzetowa wersja sse4.2
+bool crc32cHardware();
+
+#endif
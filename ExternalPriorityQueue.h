@@ -0,0 +1,382 @@
+#ifndef EXTERNAL_PRIORITY_QUEUE_H
+#define EXTERNAL_PRIORITY_QUEUE_H
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <string>
+#include <stdexcept>
+#include <type_traits>
+#include "PriorityQueue.h"
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+// kolejka priorytetowa ktora moze byc wieksza niz pamiec ram
+// w pamieci trzymamy zwykly kopiec o z gory ustalonej pojemnosci
+// jak sie zapelni to wypisujemy go w kolejnosci rosnacej do pliku tymczasowego
+// taki posortowany plik to tzw przebieg (run)
+// extractMin porownuje wierzcholek kopca z poczatkami wszystkich przebiegow
+// i czyta przebiegi po kawalku wiec dysk jest czytany i pisany tylko sekwencyjnie
+// przebiegi maja poziomy jak w drzewie lsm nowy przebieg ma poziom 0
+// a jak na jednym poziomie zbierze sie mergeFanIn przebiegow to sa scalane
+// w jeden przebieg poziomu wyzej wiec kazdy element jest przepisywany
+// tylko log o podstawie mergeFanIn z (N / pojemnosc kopca) razy
+// dane sa zapisywane binarnie wiec typ T musi byc prosty do skopiowania
+template <typename T>
+class ExternalMinPriorityQueue {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "ExternalMinPriorityQueue wymaga typu ktory mozna zapisac binarnie");
+
+private:
+    // jeden posortowany przebieg na dysku
+    struct Run {
+        FILE* file;            // plik tymczasowy z przebiegiem
+        std::string path;      // sciezka pliku zeby go usunac po zamknieciu
+        int level;             // poziom przebiegu ile razy jego dane byly scalane
+        HeapNode<T>* buffer;   // bufor odczytu
+        int bufferCount;       // ile elementow jest w buforze
+        int bufferPos;         // ktory element bufora jest nastepny
+        long long remaining;   // ile elementow zostalo jeszcze w pliku
+    };
+
+    // budzet na bufory zaklada tyle pelnych poziomow przebiegow naraz
+    static const int BUDGET_LEVELS = 4;
+
+    MinPriorityQueue<T>* heap;      // kopiec w pamieci
+    int heapCapacity;               // ile elementow moze miec kopiec zanim go wypiszemy
+    Run* runs;                      // tablica miejsc na przebiegi
+    bool* runActive;                // czy dane miejsce w tablicy jest zajete
+    int slotCapacity;               // ile jest miejsc w tablicy przebiegow
+    int mergeFanIn;                 // ile przebiegow jednego poziomu scalamy naraz
+    int activeRuns;                 // ile przebiegow jest aktualnie otwartych
+    int runBufferSize;              // ile elementow miesci bufor jednego przebiegu
+    HeapNode<T>* writeBuffer;       // bufor zapisu nowego przebiegu
+    MinPriorityQueue<int>* merge;   // kopiec numerow przebiegow wedlug ich pierwszego elementu
+    long long currentSize;          // ile elementow jest w calej kolejce
+    long long spills;               // ile razy kopiec zostal wypisany na dysk
+    std::string tempDir;            // katalog na pliki tymczasowe
+    std::string fileTag;            // numer procesu i losowy znacznik w nazwach plikow tej kolejki
+    unsigned long fileCounter;      // kolejny numer pliku
+
+    // katalog tymczasowy systemu
+    // na windows GetTempPath tez bierze go ze zmiennych TMP i TEMP
+    // nie uzywamy tmpfile bo w mingw tworzy plik w katalogu glownym dysku
+    // a tam zwykly uzytkownik nie ma prawa zapisu
+    static std::string systemTempDir() {
+        const char* names[] = {"TMPDIR", "TMP", "TEMP"};
+        for (int i = 0; i < 3; i++) {
+            const char* dir = std::getenv(names[i]);
+            if (dir && dir[0]) return dir;
+        }
+#ifdef _WIN32
+        return ".";
+#else
+        return "/tmp";
+#endif
+    }
+
+    // numer procesu zeby dwa programy w tym samym katalogu mialy rozne nazwy plikow
+    static unsigned long processId() {
+#ifdef _WIN32
+        return (unsigned long)_getpid();
+#else
+        return (unsigned long)getpid();
+#endif
+    }
+
+    // dopisuje element do bufora zapisu i zrzuca bufor do pliku jak pelny
+    void writeNode(FILE* file, int& count, const HeapNode<T>& node) {
+        writeBuffer[count++] = node;
+        if (count == runBufferSize) flushWrite(file, count);
+    }
+
+    // zapisuje zawartosc bufora zapisu do pliku
+    void flushWrite(FILE* file, int& count) {
+        if (count > 0 && std::fwrite(writeBuffer, sizeof(HeapNode<T>), count, file) != (size_t)count) {
+            throw std::runtime_error("Cannot write spill file");
+        }
+        count = 0;
+    }
+
+    // zwraca numer wolnego miejsca na przebieg
+    // jak wszystkie sa zajete to powiekszamy tablice 2 razy
+    int freeSlot() {
+        for (int i = 0; i < slotCapacity; i++) {
+            if (!runActive[i]) return i;
+        }
+        int slot = slotCapacity; // pierwsze nowe miejsce
+        size_t newCapacity = (size_t)slotCapacity * 2;
+        Run* newRuns = new Run[newCapacity];
+        bool* newActive = new bool[newCapacity];
+        for (size_t i = 0; i < newCapacity; i++) {
+            if (i < (size_t)slotCapacity) newRuns[i] = runs[i];
+            newActive[i] = i < (size_t)slotCapacity ? runActive[i] : false;
+        }
+        delete[] runs;
+        delete[] runActive;
+        runs = newRuns;
+        runActive = newActive;
+        slotCapacity = (int)newCapacity;
+        return slot;
+    }
+
+    // otwiera nowy plik tymczasowy w miejscu slot
+    FILE* openRun(int slot, int level) {
+        // nazwa z znacznikiem kolejki i numerem zeby pliki sie nie powtarzaly
+        // w+b skraca istniejacy plik wiec zajete nazwy pomijamy
+        // bo moglby to byc przebieg innej kolejki albo innego procesu
+        std::string path;
+        while (true) {
+            path = tempDir + "/extpq_" + fileTag + "_" + std::to_string(fileCounter++) + ".tmp";
+            FILE* existing = std::fopen(path.c_str(), "rb");
+            if (!existing) break;
+            std::fclose(existing);
+        }
+        FILE* file = std::fopen(path.c_str(), "w+b");
+        if (!file) throw std::runtime_error("Cannot create spill file in " + tempDir);
+        runs[slot].file = file;
+        runs[slot].path = path;
+        runs[slot].level = level;
+        runs[slot].buffer = nullptr;
+        runs[slot].bufferCount = 0;
+        runs[slot].bufferPos = 0;
+        runs[slot].remaining = 0;
+        return file;
+    }
+
+    // konczy zapis przebiegu przewija plik i wczytuje pierwszy kawalek
+    void startRun(int slot, long long count) {
+        Run& r = runs[slot];
+        std::fflush(r.file);
+        std::rewind(r.file);
+        r.remaining = count;
+        r.buffer = new HeapNode<T>[runBufferSize];
+        runActive[slot] = true;
+        activeRuns++;
+        if (refillRun(slot)) merge->insert(slot, r.buffer[0].priority);
+    }
+
+    // wczytuje kolejny kawalek przebiegu zwraca false jak przebieg sie skonczyl
+    bool refillRun(int slot) {
+        Run& r = runs[slot];
+        if (r.remaining == 0) {
+            closeRun(slot);
+            return false;
+        }
+        int toRead = r.remaining < runBufferSize ? (int)r.remaining : runBufferSize;
+        if (std::fread(r.buffer, sizeof(HeapNode<T>), toRead, r.file) != (size_t)toRead) {
+            throw std::runtime_error("Cannot read spill file");
+        }
+        r.remaining -= toRead;
+        r.bufferCount = toRead;
+        r.bufferPos = 0;
+        return true;
+    }
+
+    // zamyka przebieg usuwa jego plik i zwalnia pamiec
+    void closeRun(int slot) {
+        Run& r = runs[slot];
+        std::fclose(r.file);
+        std::remove(r.path.c_str());
+        delete[] r.buffer;
+        r.file = nullptr;
+        r.buffer = nullptr;
+        runActive[slot] = false;
+        activeRuns--;
+    }
+
+    // wyciaga najmniejszy element z przebiegow ktore sa w kopcu from
+    HeapNode<T> popFromRuns(MinPriorityQueue<int>& from) {
+        int slot = from.extractMin(); // przebieg z najmniejszym pierwszym elementem
+        Run& r = runs[slot];
+        HeapNode<T> node = r.buffer[r.bufferPos++];
+        // jak bufor sie skonczyl to czytamy dalej z pliku
+        if (r.bufferPos < r.bufferCount || refillRun(slot)) {
+            from.insert(slot, r.buffer[r.bufferPos].priority);
+        }
+        return node;
+    }
+
+    // ile przebiegow jest na danym poziomie
+    int runsOnLevel(int level) const {
+        int count = 0;
+        for (int i = 0; i < slotCapacity; i++) {
+            if (runActive[i] && runs[i].level == level) count++;
+        }
+        return count;
+    }
+
+    // scala wszystkie przebiegi jednego poziomu w jeden przebieg poziomu wyzej
+    // czytanie i pisanie jest sekwencyjne a reszta przebiegow zostaje nietknieta
+    void mergeLevel(int level) {
+        // osobny kopiec tylko z przebiegami tego poziomu
+        MinPriorityQueue<int> local(mergeFanIn);
+        for (int i = 0; i < slotCapacity; i++) {
+            if (runActive[i] && runs[i].level == level) {
+                local.insert(i, runs[i].buffer[runs[i].bufferPos].priority);
+            }
+        }
+
+        int slot = freeSlot();
+        FILE* file = openRun(slot, level + 1);
+        long long count = 0;
+        int pending = 0;
+        while (local.hasElements()) {
+            writeNode(file, pending, popFromRuns(local));
+            count++;
+        }
+        flushWrite(file, pending);
+
+        // scalone przebiegi sa juz zamkniete wiec budujemy kopiec glowny od nowa
+        // przebiegow jest malo wiec to tanie
+        while (merge->hasElements()) merge->extractMin();
+        for (int i = 0; i < slotCapacity; i++) {
+            if (runActive[i]) merge->insert(i, runs[i].buffer[runs[i].bufferPos].priority);
+        }
+        startRun(slot, count);
+    }
+
+    // wypisuje caly kopiec do nowego przebiegu poziomu 0 w kolejnosci rosnacej
+    // a potem scala poziomy ktore sie zapelnily
+    void spillHeap() {
+        int slot = freeSlot();
+        FILE* file = openRun(slot, 0);
+        long long count = 0;
+        int pending = 0;
+        while (heap->hasElements()) {
+            HeapNode<T> node;
+            node.priority = heap->peekPriority();
+            node.data = heap->extractMin();
+            writeNode(file, pending, node);
+            count++;
+        }
+        flushWrite(file, pending);
+        startRun(slot, count);
+        spills++;
+
+        for (int level = 0; runsOnLevel(level) >= mergeFanIn; level++) {
+            mergeLevel(level);
+        }
+    }
+
+    // czy nastepny element jest w kopcu w pamieci a nie w przebiegach
+    bool minInHeap() const {
+        if (!merge->hasElements()) return true;
+        if (!heap->hasElements()) return false;
+        return heap->peekPriority() <= merge->peekPriority();
+    }
+
+public:
+    // memoryBudget to limit pamieci w bajtach
+    // polowa idzie na kopiec a polowa na bufory przebiegow
+    // fanIn to ile przebiegow jednego poziomu scalamy naraz
+    // directory to katalog na pliki tymczasowe pusty oznacza katalog systemowy
+    ExternalMinPriorityQueue(long long memoryBudget = 64LL * 1024 * 1024, int fanIn = 16,
+                             const std::string& directory = "") {
+        mergeFanIn = fanIn < 2 ? 2 : fanIn;
+        long long half = memoryBudget / 2;
+        long long heapElems = half / (long long)sizeof(HeapNode<T>);
+        // bufory dla BUDGET_LEVELS poziomow przebiegow plus bufor zapisu
+        long long bufferElems = half / ((mergeFanIn * BUDGET_LEVELS + 1) * (long long)sizeof(HeapNode<T>));
+        if (heapElems < 16) heapElems = 16;
+        if (heapElems > 1 << 30) heapElems = 1 << 30;
+        if (bufferElems < 16) bufferElems = 16;
+        if (bufferElems > 1 << 20) bufferElems = 1 << 20;
+        heapCapacity = (int)heapElems;
+        runBufferSize = (int)bufferElems;
+
+        tempDir = directory.empty() ? systemTempDir() : directory;
+        // znacznik z numeru procesu oraz adresu obiektu i czasu
+        // zeby rozne kolejki i procesy sie nie mieszaly
+        fileTag = std::to_string(processId()) + "_" +
+                  std::to_string((unsigned long)(reinterpret_cast<size_t>(this) ^ (size_t)std::time(nullptr) ^ (size_t)std::clock()));
+        fileCounter = 0;
+
+        // kopiec dostaje od razu cala pojemnosc wiec nigdy sie nie podwaja
+        heap = new MinPriorityQueue<T>(heapCapacity);
+        slotCapacity = mergeFanIn + 1;
+        merge = new MinPriorityQueue<int>(slotCapacity);
+        runs = new Run[slotCapacity];
+        runActive = new bool[slotCapacity];
+        for (int i = 0; i < slotCapacity; i++) runActive[i] = false;
+        writeBuffer = new HeapNode<T>[runBufferSize];
+        activeRuns = 0;
+        currentSize = 0;
+        spills = 0;
+    }
+
+    // destruktor zamyka i usuwa pliki tymczasowe i zwalnia pamiec
+    ~ExternalMinPriorityQueue() {
+        for (int i = 0; i < slotCapacity; i++) {
+            if (runActive[i]) closeRun(i);
+        }
+        delete heap;
+        delete merge;
+        delete[] runs;
+        delete[] runActive;
+        delete[] writeBuffer;
+    }
+
+    // sprawdza czy kolejka jest pusta
+    bool isEmpty() const {
+        return currentSize == 0;
+    }
+
+    // pomocnicza funkcja sprawdzajaca czy sa elementy
+    bool hasElements() const {
+        return currentSize > 0;
+    }
+
+    // zwraca liczbe wszystkich elementow razem z tymi na dysku
+    long long size() const {
+        return currentSize;
+    }
+
+    // ile razy kopiec zostal wypisany na dysk
+    long long spillCount() const {
+        return spills;
+    }
+
+    // ile przebiegow jest aktualnie na dysku
+    int runCount() const {
+        return activeRuns;
+    }
+
+    // funkcja dodajaca nowy element
+    // jak kopiec jest pelny to najpierw wypisujemy go na dysk
+    void insert(T data, int priority) {
+        if (heap->size() == heapCapacity) spillHeap();
+        heap->insert(data, priority);
+        currentSize++;
+    }
+
+    // funkcja pobierajaca element o najmniejszym priorytecie
+    T extractMin() {
+        if (currentSize <= 0) {
+            throw std::runtime_error("Queue is empty");
+        }
+        currentSize--;
+        if (minInHeap()) return heap->extractMin();
+        return popFromRuns(*merge).data;
+    }
+
+    // podglad elementu o najmniejszym priorytecie bez usuwania
+    T peek() const {
+        if (currentSize <= 0) throw std::runtime_error("Queue is empty");
+        if (minInHeap()) return heap->peek();
+        const Run& r = runs[merge->peek()];
+        return r.buffer[r.bufferPos].data;
+    }
+
+    // podglad najmniejszego priorytetu bez usuwania
+    int peekPriority() const {
+        if (currentSize <= 0) throw std::runtime_error("Queue is empty");
+        if (minInHeap()) return heap->peekPriority();
+        return merge->peekPriority();
+    }
+};
+
+#endif
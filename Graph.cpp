@@ -0,0 +1,43 @@
+#include "Graph.h"
+
+// prosty generator liczb losowych xorshift
+// wlasny zeby wyniki byly takie same na kazdym kompilatorze
+static unsigned int nextRandom(unsigned int& state) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+Graph* generateRandomGraph(int vertexCount, int edgesPerVertex, int maxWeight, unsigned int seed) {
+    Graph* g = new Graph;
+    g->vertexCount = vertexCount;
+    g->edgeCount = vertexCount * edgesPerVertex;
+    g->offsets = new int[vertexCount + 1];
+    g->targets = new int[g->edgeCount];
+    g->weights = new int[g->edgeCount];
+
+    unsigned int state = seed ? seed : 1; // xorshift nie moze startowac od 0
+    int e = 0;
+    for (int v = 0; v < vertexCount; v++) {
+        g->offsets[v] = e;
+        for (int k = 0; k < edgesPerVertex; k++) {
+            // pierwsza krawedz idzie do nastepnego wierzcholka
+            // zeby caly graf byl osiagalny z wierzcholka 0
+            if (k == 0) g->targets[e] = (v + 1) % vertexCount;
+            else g->targets[e] = (int)(nextRandom(state) % (unsigned int)vertexCount);
+            g->weights[e] = 1 + (int)(nextRandom(state) % (unsigned int)maxWeight);
+            e++;
+        }
+    }
+    g->offsets[vertexCount] = e;
+    return g;
+}
+
+void deleteGraph(Graph* g) {
+    if (!g) return;
+    delete[] g->offsets;
+    delete[] g->targets;
+    delete[] g->weights;
+    delete g;
+}
@@ -0,0 +1,60 @@
+#ifndef GRAPH_H
+#define GRAPH_H
+
+#include <climits>
+#include "RadixHeap.h"
+
+// graf skierowany z wagami trzymany w postaci list sasiedztwa w tablicach
+// krawedzie wierzcholka v to indeksy od offsets[v] do offsets[v + 1] - 1
+struct Graph {
+    int vertexCount; // liczba wierzcholkow
+    int edgeCount;   // liczba krawedzi
+    int* offsets;    // poczatek krawedzi kazdego wierzcholka (vertexCount + 1 wpisow)
+    int* targets;    // dokad prowadzi krawedz
+    int* weights;    // waga krawedzi
+};
+
+// generuje losowy graf gdzie kazdy wierzcholek ma edgesPerVertex krawedzi
+// wagi sa z przedzialu od 1 do maxWeight a seed ustala losowanie
+Graph* generateRandomGraph(int vertexCount, int edgesPerVertex, int maxWeight, unsigned int seed);
+
+// zwalnia pamiec grafu
+void deleteGraph(Graph* g);
+
+// algorytm dijkstry liczacy najkrotsze odleglosci od wierzcholka source
+// Monotone wybiera kolejke false to kopiec a true to radix heap
+// zamiast decreaseKey ktore szuka liniowo wstawiamy wierzcholek ponownie
+// a stare wpisy pomijamy przy wyciaganiu dzieki tablicy done
+// nieosiagalne wierzcholki dostaja odleglosc INT_MAX
+template <bool Monotone>
+void dijkstra(const Graph& g, int source, int* dist) {
+    typename SelectPriorityQueue<int, Monotone>::type pq(g.vertexCount);
+    bool* done = new bool[g.vertexCount]; // czy odleglosc jest juz ostateczna
+
+    for (int v = 0; v < g.vertexCount; v++) {
+        dist[v] = INT_MAX;
+        done[v] = false;
+    }
+    dist[source] = 0;
+    pq.insert(source, 0);
+
+    while (!pq.isEmpty()) {
+        int u = pq.extractMin(); // najblizszy nieodwiedzony wierzcholek
+        if (done[u]) continue; // stary wpis juz go przetworzylismy
+        done[u] = true;
+
+        // relaksacja krawedzi wychodzacych z u
+        for (int e = g.offsets[u]; e < g.offsets[u + 1]; e++) {
+            int v = g.targets[e];
+            int candidate = dist[u] + g.weights[e];
+            if (!done[v] && candidate < dist[v]) {
+                dist[v] = candidate;
+                pq.insert(v, candidate);
+            }
+        }
+    }
+
+    delete[] done;
+}
+
+#endif
@@ -1,6 +1,78 @@
 #include "Huffman.h"
+#include "Crc32c.h"
+#include "HuffmanWide.h"
 #include <iostream>
 
+// lista zaczyna od miejsca na 16 sum
+ChecksumList::ChecksumList() : count(0), capacity(16) {
+    values = new unsigned int[capacity];
+}
+
+ChecksumList::~ChecksumList() {
+    delete[] values;
+}
+
+void ChecksumList::addBlock(const unsigned char* data, int n) {
+    // jak brakuje miejsca na sume to powiekszamy tablice 2 razy
+    if (count == capacity) {
+        unsigned int* bigger = new unsigned int[capacity * 2];
+        for (int i = 0; i < count; i++) bigger[i] = values[i];
+        delete[] values;
+        values = bigger;
+        capacity *= 2;
+    }
+    values[count++] = crc32c(data, n); // suma dla bloku
+}
+
+CheckedBlockSink::CheckedBlockSink(const std::string& file, bool verifyOnly, const unsigned int* expected,
+                                   int size, long long totalBytes)
+    : outputFile(file), writer(nullptr), checksums(expected), blockSize(size), blockFill(0), blockIndex(0) {
+    // blok nie musi byc wiekszy niz caly wynik
+    if (totalBytes > 0 && totalBytes < blockSize) blockSize = (int)totalBytes;
+    block = new unsigned char[blockSize];
+    if (!verifyOnly) {
+        // otwieramy plik wyjsciowy a pisarz w tle zapisuje wynik
+        // dzieki temu dekoder nie czeka na dysk
+        out.open(outputFile, std::ios::binary);
+        writer = new AsyncWriter(out);
+    }
+}
+
+CheckedBlockSink::~CheckedBlockSink() {
+    delete writer; // destruktor pisarza dopisze reszte jak finish nie byl wolany
+    delete[] block;
+}
+
+bool CheckedBlockSink::finishBlock() {
+    if (checksums && crc32c(block, blockFill) != checksums[blockIndex]) {
+        std::cerr << "Blad sumy kontrolnej w bloku " << blockIndex << "!\n";
+        return false;
+    }
+    if (writer) writer->write(block, blockFill);
+    blockIndex++;
+    blockFill = 0;
+    return true;
+}
+
+bool CheckedBlockSink::finish() {
+    bool ok = true;
+    if (blockFill > 0) ok = finishBlock(); // ostatni niepelny blok
+    // czekamy az pisarz zapisze wszystkie bloki na dysk
+    if (writer && !writer->finish()) {
+        std::cerr << "Blad zapisu do pliku: " << outputFile << "\n";
+        ok = false;
+    }
+    return ok;
+}
+
+long long remainingBytes(std::ifstream& in) {
+    std::streampos pos = in.tellg();
+    in.seekg(0, std::ios::end);
+    long long remaining = (long long)(in.tellg() - pos);
+    in.seekg(pos);
+    return remaining;
+}
+
 // funkcja do usuwania drzewa z pamieci
 // zeby nie bylo wyciekow pamieci jak juz nie potrzebujemy drzewa
 void deleteTree(HuffmanNode* root) {
@@ -42,12 +114,24 @@ void compressFile(const std::string& inputFile, const std::string& outputFile) {
     unsigned char c; // zmienna na wczytywany znak
     long long totalChars = 0; // licznik wszystkich znakow w pliku
     
-    char readBuf; // bufor do czytania z pliku
-    // petla czytajaca plik znak po znaku
-    while (in.get(readBuf)) {
-        frequencies[(unsigned char)readBuf]++; // zwiekszamy licznik dla danego znaku
-        totalChars++; // zwiekszamy ogolny licznik znakow
-    }
+    // sumy kontrolne kolejnych blokow pliku liczone przy okazji zliczania
+    ChecksumList checksums;
+
+    {
+        // czytnik w tle laduje kolejne bloki pliku a my w tym czasie liczymy
+        AsyncReader reader(in);
+        unsigned char* block = new unsigned char[CHECKSUM_BLOCK_SIZE];
+        int n;
+        // petla czytajaca plik blokami
+        while ((n = reader.read(block, CHECKSUM_BLOCK_SIZE)) > 0) {
+            for (int i = 0; i < n; i++) {
+                frequencies[block[i]]++; // zwiekszamy licznik dla danego znaku
+            }
+            totalChars += n; // zwiekszamy ogolny licznik znakow
+            checksums.addBlock(block, n); // suma dla bloku
+        }
+        delete[] block;
+    } // tutaj watek czytajacy sie konczy wiec mozna ruszac strumien
     
     // czyscimy flagi bledow strumienia bo doszlismy do konca pliku
     in.clear(); 
@@ -99,6 +183,15 @@ void compressFile(const std::string& inputFile, const std::string& outputFile) {
 
     // otwieramy plik wyjsciowy do zapisu w trybie binarnym
     std::ofstream out(outputFile, std::ios::binary);
+
+    // na poczatku sekcja sum kontrolnych crc32c
+    // rozmiar bloku liczba blokow i sumy zapisane szesnastkowo
+    out << "CRC32C " << CHECKSUM_BLOCK_SIZE << " " << checksums.count << "\n";
+    out << std::hex;
+    for (int i = 0; i < checksums.count; i++) {
+        out << checksums.values[i] << (i + 1 < checksums.count ? " " : "\n");
+    }
+    out << std::dec;
     
     // zapisujemy calkowita liczbe znakow w naglowku
     // zeby przy dekompresji wiedziec ile bitow czytac
@@ -123,13 +216,16 @@ void compressFile(const std::string& inputFile, const std::string& outputFile) {
         out << "\n"; // nowa linia
     }
 
+    // potok trzech etapow czytnik w tle koder w tym watku i pisarz w tle
+    // naglowek jest juz zapisany wiec pisarz dopisuje dane za nim
+    AsyncReader reader(in);
+    AsyncWriter writer(out);
     // tworzymy obiekt bitwriter do zapisywania bitow
-    BitWriter bw(out);
+    BitWriter bw(writer);
     
     // czytamy plik wejsciowy jeszcze raz od poczatku
-    while(in.get(readBuf)) {
-        unsigned char uc = (unsigned char)readBuf; // rzutujemy na unsigned char
-        std::string code = codes.get(uc); // pobieramy kod binarny dla znaku
+    while(reader.get(c)) {
+        std::string code = codes.get(c); // pobieramy kod binarny dla znaku
         // przelatujemy przez stringa z zerami i jedynkami
         for(char bitChar : code) {
             // konwertujemy znak '0' lub '1' na liczbe i zapisujemy
@@ -139,36 +235,95 @@ void compressFile(const std::string& inputFile, const std::string& outputFile) {
     // zapisujemy to co zostalo w buforze na koniec
     bw.flush();
 
+    // czekamy az pisarz zapisze wszystkie bloki na dysk
+    if (!writer.finish()) {
+        std::cerr << "Blad zapisu do pliku: " << outputFile << "\n";
+        deleteTree(root);
+        return;
+    }
+
     std::cout << "Kompresja zakonczona. Zapisano do " << outputFile << "\n"; // sukces
     
     // sprzatamy pamiec usuwajac drzewo
     deleteTree(root);
 }
 
-// funkcja do dekompresji pliku
-void decompressFile(const std::string& inputFile, const std::string& outputFile) {
+// wspolna funkcja dekodujaca dla dekompresji i trybu testu
+// jak verifyOnly jest true to nic nie zapisujemy tylko sprawdzamy sumy kontrolne
+static bool decodeFile(const std::string& inputFile, const std::string& outputFile, bool verifyOnly) {
     // otwieramy plik skompresowany
     std::ifstream in(inputFile, std::ios::binary);
     // sprawdzamy czy istnieje
     if (!in.is_open()) {
         std::cerr << "Nie mozna otworzyc pliku: " << inputFile << "\n";
-        return;
+        return false;
     }
 
     std::cout << "Otwieranie pliku " << inputFile << "...\n";
 
+    // plik w formacie szerokiego alfabetu zaczyna sie od znacznika HUFW
+    if (in.peek() == 'H') {
+        return decodeFileWide(in, outputFile, verifyOnly);
+    }
+
+    // sekcja sum kontrolnych zaczyna sie od slowa CRC32C
+    // stare pliki zaczynaja sie od razu od liczby znakow i nie maja sum
+    int blockSize = CHECKSUM_BLOCK_SIZE; // rozmiar bloku objetego jedna suma
+    int checksumCount = 0;               // ile sum jest w pliku
+    unsigned int* checksums = nullptr;   // oczekiwane sumy kolejnych blokow
+    in >> std::ws; // pomijamy ewentualne biale znaki
+    if (in.peek() == 'C') {
+        std::string tag;
+        if (!(in >> tag >> blockSize >> checksumCount) || tag != "CRC32C" ||
+            blockSize <= 0 || blockSize > (1 << 26) || checksumCount < 0) {
+            std::cerr << "Blad odczytu naglowka (CRC32C).\n";
+            return false;
+        }
+        // kazda suma zajmuje w pliku co najmniej 2 znaki (cyfra i odstep)
+        // wiec liczbe sum sprawdzamy z reszta pliku zanim zaalokujemy tablice
+        if (checksumCount > remainingBytes(in) / 2 + 1) {
+            std::cerr << "Liczba sum kontrolnych wieksza niz rozmiar pliku.\n";
+            return false;
+        }
+        checksums = new unsigned int[checksumCount > 0 ? checksumCount : 1];
+        in >> std::hex;
+        for (int i = 0; i < checksumCount; i++) {
+            if (!(in >> checksums[i])) {
+                std::cerr << "Blad odczytu sum kontrolnych.\n";
+                delete[] checksums;
+                return false;
+            }
+        }
+        in >> std::dec;
+    } else {
+        std::cout << "Plik w starym formacie bez sum kontrolnych.\n";
+        if (verifyOnly) {
+            std::cerr << "Nie mozna zweryfikowac pliku bez sum kontrolnych.\n";
+            return false;
+        }
+    }
+
     // czytamy z naglowka ile ma byc wszystkich znakow po odkodowaniu
     long long totalChars;
-    if (!(in >> totalChars)) {
+    if (!(in >> totalChars) || totalChars < 0) {
         std::cerr << "Blad odczytu naglowka (totalChars).\n"; // blad jak sie nie da
-        return;
+        delete[] checksums;
+        return false;
+    }
+
+    // liczba sum musi pasowac do liczby blokow
+    if (checksums && checksumCount != (totalChars + blockSize - 1) / blockSize) {
+        std::cerr << "Liczba sum kontrolnych nie zgadza sie z rozmiarem pliku.\n";
+        delete[] checksums;
+        return false;
     }
     
     // czytamy ile wpisow ma slownik
     int dictSize;
     if (!(in >> dictSize)) {
         std::cerr << "Blad odczytu naglowka (dictSize).\n"; // blad
-        return;
+        delete[] checksums;
+        return false;
     }
     
     // musimy pominac znak nowej linii ktory zostal po wczytaniu liczby
@@ -214,21 +369,26 @@ void decompressFile(const std::string& inputFile, const std::string& outputFile)
     // wiec jestesmy gotowi do czytania danych binarnych
  
 
-    // otwieramy plik wyjsciowy do zapisu odzyskanego tekstu
-    std::ofstream out(outputFile, std::ios::binary);
+    // odkodowane znaki trafiaja do odbiornika ktory sprawdza sume kazdego bloku
+    // zanim przekaze go do pliku w trybie testu nic nie jest zapisywane
+    CheckedBlockSink sink(outputFile, verifyOnly, checksums, blockSize, totalChars);
+    // czytnik w tle wczytuje dane binarne
+    AsyncReader reader(in);
     // tworzymy bitreader do czytania bitow
-    BitReader br(in);
+    BitReader br(reader);
     
     HuffmanNode* curr = root; // wskaznik do chodzenia po drzewie
     long long charsDecoded = 0; // licznik odkodowanych znakow
+    bool ok = true; // czy wszystko poszlo dobrze
 
-    std::cout << "Dekodowanie tresci...\n";
+    std::cout << (verifyOnly ? "Weryfikacja tresci...\n" : "Dekodowanie tresci...\n");
 
     // petla dziala dopoki nie odzyskamy wszystkich znakow
     while (charsDecoded < totalChars) {
         int bit = br.readBit(); // czytamy jeden bit
         if (bit == -1) { // jak koniec pliku to przerywamy
             std::cerr << "Nieoczekiwany koniec pliku! Odczytano " << charsDecoded << " z " << totalChars << " znakow.\n";
+            ok = false;
             break; 
         }
 
@@ -239,18 +399,47 @@ void decompressFile(const std::string& inputFile, const std::string& outputFile)
         // zabezpieczenie jakby drzewo bylo uszkodzone
         if (!curr) {
              std::cerr << "Blad struktury drzewa/sciezki!\n";
+             ok = false;
              break;
         }
 
         // sprawdzamy czy to lisc
         if (curr->isLeaf()) {
-            out.put(curr->character); // zapisujemy odzyskany znak
             charsDecoded++; // zwiekszamy licznik
+            // zapisujemy odzyskany znak pelny blok jest od razu sprawdzany
+            if (!sink.put(curr->character)) {
+                ok = false;
+                break;
+            }
             curr = root; // wracamy do korzenia zeby szukac nastepnego znaku
         }
     }
+    // sprawdzamy ostatni niepelny blok i czekamy az pisarz zapisze wszystko
+    // po bledzie pisarz dopisze tylko bloki ktore juz przeszly sprawdzenie
+    if (ok) ok = sink.finish();
 
-    std::cout << "Dekompresja zakonczona. Zapisano do " << outputFile << "\n"; // sukces
     // sprzatamy pamiec
+    delete[] checksums;
     deleteTree(root);
+    return ok;
+}
+
+// funkcja do dekompresji pliku
+void decompressFile(const std::string& inputFile, const std::string& outputFile) {
+    if (decodeFile(inputFile, outputFile, false)) {
+        std::cout << "Dekompresja zakonczona. Zapisano do " << outputFile << "\n"; // sukces
+    } else {
+        std::cerr << "Dekompresja nie powiodla sie.\n";
+    }
+}
+
+// funkcja sprawdzajaca archiwum bez zapisywania wyniku
+bool verifyFile(const std::string& inputFile) {
+    bool ok = decodeFile(inputFile, "", true);
+    if (ok) {
+        std::cout << "Plik " << inputFile << " jest poprawny.\n";
+    } else {
+        std::cerr << "Plik " << inputFile << " jest uszkodzony.\n";
+    }
+    return ok;
 }
@@ -5,6 +5,62 @@
 #include <fstream>
 #include <string>
 #include "PriorityQueue.h"
+#include "AsyncIO.h"
+
+// ile bajtow oryginalnego pliku obejmuje jedna suma kontrolna crc32c
+const int CHECKSUM_BLOCK_SIZE = 1 << 16;
+
+// lista sum kontrolnych kolejnych blokow zbierana przy kompresji
+// prosta tablica dynamiczna ktora podwaja sie jak braknie miejsca
+struct ChecksumList {
+    unsigned int* values; // sumy kolejnych blokow
+    int count;            // ile sum juz mamy
+    int capacity;         // pojemnosc tablicy
+
+    ChecksumList();
+    ~ChecksumList();
+
+    // liczy sume dla bloku danych i dopisuje ja na koniec
+    void addBlock(const unsigned char* data, int n);
+};
+
+// odbiornik odkodowanych bajtow wspolny dla obu dekoderow
+// zbiera bajty w bloku i sprawdza jego sume zanim odda go pisarzowi
+// dzieki temu uszkodzony blok nigdy nie trafia do pliku
+// w trybie testu plik wyjsciowy nie jest nawet otwierany
+class CheckedBlockSink {
+    std::string outputFile;         // nazwa pliku do komunikatow
+    std::ofstream out;              // plik wyjsciowy (zamkniety w trybie testu)
+    AsyncWriter* writer;            // pisarz w tle albo nullptr w trybie testu
+    const unsigned int* checksums;  // oczekiwane sumy albo nullptr dla starego formatu
+    int blockSize;                  // ile bajtow obejmuje jedna suma
+    unsigned char* block;           // bufor aktualnego bloku
+    int blockFill;                  // ile bajtow jest w buforze
+    int blockIndex;                 // numer aktualnego bloku
+
+    // sprawdza sume zebranego bloku i oddaje go pisarzowi
+    bool finishBlock();
+
+public:
+    // totalBytes to rozmiar calego wyniku zeby nie alokowac wiekszego bloku niz trzeba
+    CheckedBlockSink(const std::string& file, bool verifyOnly, const unsigned int* expected,
+                     int size, long long totalBytes);
+    ~CheckedBlockSink();
+
+    // dopisuje bajt zwraca false jak pelny blok ma zla sume
+    bool put(unsigned char c) {
+        block[blockFill++] = c;
+        if (blockFill == blockSize) return finishBlock();
+        return true;
+    }
+
+    // sprawdza ostatni niepelny blok i czeka na zapis zwraca czy wszystko sie udalo
+    bool finish();
+};
+
+// ile bajtow zostalo w pliku od aktualnej pozycji
+// sluzy do sprawdzania liczb z naglowka zanim cos zaalokujemy
+long long remainingBytes(std::ifstream& in);
 
 // struktura wezla uzywana w drzewie huffmana
 struct HuffmanNode {
@@ -84,18 +140,21 @@ void generateCodes(HuffmanNode* root, std::string currentCode, SimpleMap& map);
 // glowne funkcje sterujace
 void compressFile(const std::string& inputFile, const std::string& outputFile);
 void decompressFile(const std::string& inputFile, const std::string& outputFile);
+// tryb testu dekoduje i sprawdza sumy kontrolne bez zapisywania wyniku
+bool verifyFile(const std::string& inputFile);
 
 // klasa pomocnicza do zapisu bitowego
 // normalnie mozna zapisywac tylko bajty czyli 8 bitow
 // ta klasa buforuje bity i zapisuje caly bajt jak sie uzbiera
+// bajty trafiaja do asynchronicznego pisarza ktory zapisuje je w tle
 class BitWriter {
-    std::ofstream& out; // referencja do pliku
+    AsyncWriter& out; // referencja do pisarza
     unsigned char buffer; // bufor na 8 bitow
     int bitCount;         // licznik ile bitow juz mamy
 
 public:
     // konstruktor przypisuje strumien
-    BitWriter(std::ofstream& stream) : out(stream), buffer(0), bitCount(0) {}
+    BitWriter(AsyncWriter& stream) : out(stream), buffer(0), bitCount(0) {}
 
     // funkcja dodajaca jeden bit do bufora
     void writeBit(int bit) {
@@ -123,21 +182,22 @@ public:
 
 // klasa pomocnicza do odczytu bitowego
 // dziala odwrotnie pobiera bajt z pliku i wydaje po jednym bicie
+// bajty sa wczytywane z wyprzedzeniem przez asynchroniczny czytnik
 class BitReader {
-    std::ifstream& in; // strumien wejsciowy
+    AsyncReader& in; // czytnik wejsciowy
     unsigned char buffer; // bufor na aktualny bajt
     int bitCount; // ile bitow jeszcze zostalo w buforze
 
 public:
     // konstruktor
-    BitReader(std::ifstream& stream) : in(stream), buffer(0), bitCount(0) {}
+    BitReader(AsyncReader& stream) : in(stream), buffer(0), bitCount(0) {}
 
     // funkcja zwracajaca kolejny bit 0 lub 1
     int readBit() {
         // jak bufor pusty to czytamy nowy bajt z pliku
         if (bitCount == 0) {
             // probujemy czytac jak sie nie uda to koniec pliku
-            if (!in.get(reinterpret_cast<char&>(buffer))) return -1; 
+            if (!in.get(buffer)) return -1;
             bitCount = 8; // mamy nowych 8 bitow
         }
 
@@ -0,0 +1,621 @@
+#include "HuffmanWide.h"
+#include "Huffman.h"
+#include "AsyncIO.h"
+#include <iostream>
+
+// znacznik na poczatku pliku w formacie szerokim
+static const char WIDE_MAGIC[4] = {'H', 'U', 'F', 'W'};
+
+// wpis tablicy dekodera z ustawionym najstarszym bitem to odnosnik do drugiej tablicy
+// bity 0-23 to poczatek podtablicy a bity 24-28 ile bitow ona obsluguje
+// zwykly wpis to symbol w bitach 0-15 i dlugosc kodu w bitach 16-20
+// dlugosc 0 oznacza ze taki kod nie istnieje
+static const unsigned int WIDE_LINK_FLAG = 0x80000000u;
+
+// funkcje do zapisu liczb binarnie w kolejnosci little endian
+static void writeU8(std::ofstream& out, unsigned int v) {
+    out.put((char)(v & 0xFF));
+}
+
+static void writeU32(std::ofstream& out, unsigned int v) {
+    for (int i = 0; i < 4; i++) out.put((char)((v >> (8 * i)) & 0xFF));
+}
+
+static void writeU64(std::ofstream& out, unsigned long long v) {
+    for (int i = 0; i < 8; i++) out.put((char)((v >> (8 * i)) & 0xFF));
+}
+
+// liczba zapisana po 7 bitow na bajt male liczby zajmuja jeden bajt
+static void writeVarint(std::ofstream& out, unsigned int v) {
+    while (v >= 0x80) {
+        out.put((char)((v & 0x7F) | 0x80)); // najstarszy bit mowi ze bedzie nastepny bajt
+        v >>= 7;
+    }
+    out.put((char)v);
+}
+
+// funkcje do odczytu zwracaja false jak skonczyl sie plik
+static bool readU8(std::ifstream& in, unsigned int& v) {
+    char c;
+    if (!in.get(c)) return false;
+    v = (unsigned char)c;
+    return true;
+}
+
+static bool readU32(std::ifstream& in, unsigned int& v) {
+    v = 0;
+    for (int i = 0; i < 4; i++) {
+        unsigned int b;
+        if (!readU8(in, b)) return false;
+        v |= b << (8 * i);
+    }
+    return true;
+}
+
+static bool readU64(std::ifstream& in, unsigned long long& v) {
+    v = 0;
+    for (int i = 0; i < 8; i++) {
+        unsigned int b;
+        if (!readU8(in, b)) return false;
+        v |= (unsigned long long)b << (8 * i);
+    }
+    return true;
+}
+
+static bool readVarint(std::ifstream& in, unsigned int& v) {
+    v = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+        unsigned int b;
+        if (!readU8(in, b)) return false;
+        v |= (b & 0x7F) << shift;
+        if (!(b & 0x80)) return true;
+    }
+    return false; // za dluga liczba czyli plik uszkodzony
+}
+
+// zliczanie symboli w jednym bloku danych
+// dla 8 bitow uzywamy 4 osobnych tablic licznikow bo kolejne takie same bajty
+// zwiekszalyby ten sam licznik i procesor musialby czekac na poprzedni zapis
+// dla 16 bitow tablica ma 65536 wpisow wiec powtorzenia sa rzadkie
+static void countBlock(const unsigned char* data, int n, int symbolBits, long long* freq) {
+    if (symbolBits == 8) {
+        unsigned int sub[4][256] = {{0}};
+        int i = 0;
+        for (; i + 4 <= n; i += 4) {
+            sub[0][data[i]]++;
+            sub[1][data[i + 1]]++;
+            sub[2][data[i + 2]]++;
+            sub[3][data[i + 3]]++;
+        }
+        for (; i < n; i++) sub[0][data[i]]++;
+        for (int s = 0; s < 256; s++) {
+            freq[s] += sub[0][s] + sub[1][s] + sub[2][s] + sub[3][s];
+        }
+    } else {
+        // ostatni nieparzysty bajt nie tworzy symbolu
+        for (int i = 0; i + 1 < n; i += 2) {
+            freq[data[i] | (data[i + 1] << 8)]++;
+        }
+    }
+}
+
+// stabilne sortowanie przez scalanie symboli rosnaco wedlug czestosci
+// przy rownych czestosciach zostaje kolejnosc symboli
+static void sortByFrequency(int* symbols, int n, const long long* freq) {
+    int* temp = new int[n];
+    for (int width = 1; width < n; width *= 2) {
+        for (int lo = 0; lo < n; lo += 2 * width) {
+            int mid = lo + width < n ? lo + width : n;
+            int hi = lo + 2 * width < n ? lo + 2 * width : n;
+            int a = lo, b = mid, k = lo;
+            while (a < mid && b < hi) {
+                temp[k++] = freq[symbols[b]] < freq[symbols[a]] ? symbols[b++] : symbols[a++];
+            }
+            while (a < mid) temp[k++] = symbols[a++];
+            while (b < hi) temp[k++] = symbols[b++];
+        }
+        for (int i = 0; i < n; i++) symbols[i] = temp[i];
+    }
+    delete[] temp;
+}
+
+// algorytm moffata i katajainena liczacy dlugosci kodow huffmana w miejscu
+// wejscie to czestosci posortowane rosnaco (n >= 2)
+// wyjscie to dlugosci kodow A[0] jest najdluzszy
+// nie potrzebuje drzewa ani kolejki wiec dziala w O n po posortowaniu
+static void minimumRedundancyLengths(long long* A, int n) {
+    // faza 1 laczenie wezlow w miejscu zostawiamy indeksy rodzicow
+    A[0] += A[1];
+    int root = 0, leaf = 2;
+    for (int next = 1; next < n - 1; next++) {
+        // pierwsze dziecko
+        if (leaf >= n || A[root] < A[leaf]) {
+            A[next] = A[root];
+            A[root++] = next;
+        } else {
+            A[next] = A[leaf++];
+        }
+        // drugie dziecko
+        if (leaf >= n || (root < next && A[root] < A[leaf])) {
+            A[next] += A[root];
+            A[root++] = next;
+        } else {
+            A[next] += A[leaf++];
+        }
+    }
+
+    // faza 2 glebokosci wezlow wewnetrznych
+    A[n - 2] = 0;
+    for (int next = n - 3; next >= 0; next--) {
+        A[next] = A[A[next]] + 1;
+    }
+
+    // faza 3 glebokosci lisci
+    int available = 1, used = 0, depth = 0;
+    root = n - 2;
+    int next = n - 1;
+    while (available > 0) {
+        while (root >= 0 && A[root] == depth) {
+            used++;
+            root--;
+        }
+        while (available > used) {
+            A[next--] = depth;
+            available--;
+        }
+        available = 2 * used;
+        depth++;
+        used = 0;
+    }
+}
+
+// liczy dlugosci kodow dla wszystkich symboli alfabetu
+// kody dluzsze niz WIDE_MAX_CODE_LENGTH sa skracane a nierownosc krafta
+// naprawiana przesuwaniem pojedynczych symboli o jeden poziom w dol
+static void buildCodeLengths(const long long* freq, int alphabetSize, unsigned char* lengths) {
+    int n = 0;
+    for (int s = 0; s < alphabetSize; s++) {
+        lengths[s] = 0;
+        if (freq[s] > 0) n++;
+    }
+    if (n == 0) return;
+
+    int* sorted = new int[n];
+    n = 0;
+    for (int s = 0; s < alphabetSize; s++) {
+        if (freq[s] > 0) sorted[n++] = s;
+    }
+
+    // jeden symbol dostaje kod jednobitowy
+    if (n == 1) {
+        lengths[sorted[0]] = 1;
+        delete[] sorted;
+        return;
+    }
+
+    sortByFrequency(sorted, n, freq);
+    long long* A = new long long[n];
+    for (int i = 0; i < n; i++) A[i] = freq[sorted[i]];
+    minimumRedundancyLengths(A, n);
+
+    // ile symboli ma kazda dlugosc za dlugie kody liczymy jako najdluzsze
+    long long count[WIDE_MAX_CODE_LENGTH + 2] = {0};
+    for (int i = 0; i < n; i++) {
+        count[A[i] > WIDE_MAX_CODE_LENGTH ? WIDE_MAX_CODE_LENGTH : A[i]]++;
+    }
+
+    // suma krafta liczona w jednostkach 2^-WIDE_MAX_CODE_LENGTH
+    long long kraft = 0;
+    for (int len = 1; len <= WIDE_MAX_CODE_LENGTH; len++) {
+        kraft += count[len] << (WIDE_MAX_CODE_LENGTH - len);
+    }
+    // dopoki kody sie nie mieszcza przesuwamy najglebszy mozliwy symbol o poziom nizej
+    while (kraft > (1LL << WIDE_MAX_CODE_LENGTH)) {
+        int len = WIDE_MAX_CODE_LENGTH - 1;
+        while (count[len] == 0) len--;
+        count[len]--;
+        count[len + 1]++;
+        kraft -= 1LL << (WIDE_MAX_CODE_LENGTH - len - 1);
+    }
+
+    // najrzadsze symbole dostaja najdluzsze kody
+    int i = 0;
+    for (int len = WIDE_MAX_CODE_LENGTH; len >= 1; len--) {
+        for (long long k = 0; k < count[len]; k++) {
+            lengths[sorted[i++]] = (unsigned char)len;
+        }
+    }
+
+    delete[] A;
+    delete[] sorted;
+}
+
+// przypisuje kody kanoniczne czyli kolejne liczby w obrebie tej samej dlugosci
+// dzieki temu w naglowku wystarcza same dlugosci
+static void buildCanonicalCodes(const unsigned char* lengths, int alphabetSize, unsigned int* codes) {
+    unsigned int count[WIDE_MAX_CODE_LENGTH + 1] = {0};
+    for (int s = 0; s < alphabetSize; s++) {
+        if (lengths[s]) count[lengths[s]]++;
+    }
+    unsigned int nextCode[WIDE_MAX_CODE_LENGTH + 1] = {0};
+    unsigned int code = 0;
+    for (int len = 1; len <= WIDE_MAX_CODE_LENGTH; len++) {
+        code = (code + count[len - 1]) << 1;
+        nextCode[len] = code;
+    }
+    for (int s = 0; s < alphabetSize; s++) {
+        if (lengths[s]) codes[s] = nextCode[lengths[s]]++;
+    }
+}
+
+// dwupoziomowa tablica dekodera
+// pierwsza tablica rozpoznaje kody do WIDE_PRIMARY_BITS bitow od razu
+// dluzsze kody maja wlasna mala podtablice dla kazdego prefiksu
+// zwykle calosc zajmuje kilkadziesiat KB wiec miesci sie w cache L2
+struct WideDecodeTable {
+    unsigned int* primary;   // 2^WIDE_PRIMARY_BITS wpisow
+    unsigned int* secondary; // wszystkie podtablice jedna za druga
+
+    WideDecodeTable() : primary(nullptr), secondary(nullptr) {}
+    ~WideDecodeTable() {
+        delete[] primary;
+        delete[] secondary;
+    }
+
+    void build(const unsigned char* lengths, const unsigned int* codes, int alphabetSize) {
+        const int P = WIDE_PRIMARY_BITS;
+        primary = new unsigned int[1 << P]();
+
+        // najdluzszy kod dla kazdego prefiksu wyznacza rozmiar podtablicy
+        int* prefixMax = new int[1 << P]();
+        for (int s = 0; s < alphabetSize; s++) {
+            int len = lengths[s];
+            if (len > P) {
+                unsigned int prefix = codes[s] >> (len - P);
+                if (len > prefixMax[prefix]) prefixMax[prefix] = len;
+            }
+        }
+        unsigned int offset = 0;
+        for (int p = 0; p < (1 << P); p++) {
+            if (prefixMax[p]) {
+                unsigned int sub = prefixMax[p] - P;
+                primary[p] = WIDE_LINK_FLAG | (sub << 24) | offset;
+                offset += 1u << sub;
+            }
+        }
+        secondary = new unsigned int[offset > 0 ? offset : 1]();
+
+        // wpisujemy kazdy kod we wszystkie pasujace miejsca
+        for (int s = 0; s < alphabetSize; s++) {
+            int len = lengths[s];
+            if (!len) continue;
+            unsigned int entry = (unsigned int)s | ((unsigned int)len << 16);
+            if (len <= P) {
+                unsigned int start = codes[s] << (P - len);
+                for (unsigned int k = 0; k < (1u << (P - len)); k++) primary[start + k] = entry;
+            } else {
+                unsigned int link = primary[codes[s] >> (len - P)];
+                int sub = (link >> 24) & 31;
+                unsigned int rest = codes[s] & ((1u << (len - P)) - 1); // bity po prefiksie
+                unsigned int start = (link & 0xFFFFFF) + (rest << (sub - (len - P)));
+                for (unsigned int k = 0; k < (1u << (sub - (len - P))); k++) secondary[start + k] = entry;
+            }
+        }
+        delete[] prefixMax;
+    }
+};
+
+// zapis bitowy z 64 bitowym akumulatorem
+// caly kod wrzucamy jednym przesunieciem zamiast bit po bicie
+class WideBitWriter {
+    AsyncWriter& out;
+    unsigned long long acc; // bity czekajace na zapis (najmlodsze bits bitow)
+    int bits;               // ile bitow jest w akumulatorze
+
+public:
+    WideBitWriter(AsyncWriter& stream) : out(stream), acc(0), bits(0) {}
+
+    void write(unsigned int code, int len) {
+        acc = (acc << len) | code;
+        bits += len;
+        while (bits >= 8) {
+            bits -= 8;
+            out.put((unsigned char)(acc >> bits));
+        }
+    }
+
+    // dopelnia ostatni bajt zerami
+    void flush() {
+        if (bits > 0) out.put((unsigned char)(acc << (8 - bits)));
+        bits = 0;
+    }
+};
+
+// odczyt bitowy z 64 bitowym akumulatorem wyrownanym do lewej
+// po koncu pliku doklada zera a licznik realBits pozwala wykryc urwany plik
+class WideBitReader {
+    AsyncReader& in;
+    bool exhausted;       // czy czytnik nie ma juz danych
+
+public:
+    unsigned long long acc; // najstarsze bity to nastepne bity strumienia
+    int bits;               // ile bitow jest w akumulatorze
+    long long realBits;     // ile bitow naprawde przeczytano z pliku
+    long long usedBits;     // ile bitow zuzyl dekoder
+
+    WideBitReader(AsyncReader& stream)
+        : in(stream), exhausted(false), acc(0), bits(0), realBits(0), usedBits(0) {}
+
+    // uzupelnia akumulator do ponad 56 bitow
+    void refill() {
+        while (bits <= 56) {
+            unsigned char b = 0;
+            if (!exhausted) {
+                if (in.get(b)) realBits += 8;
+                else exhausted = true;
+            }
+            acc |= (unsigned long long)b << (56 - bits);
+            bits += 8;
+        }
+    }
+
+    void consume(int len) {
+        acc <<= len;
+        bits -= len;
+        usedBits += len;
+    }
+};
+
+void compressFileWide(const std::string& inputFile, const std::string& outputFile, int symbolBits) {
+    if (symbolBits != 8 && symbolBits != 16) {
+        std::cerr << "Nieobslugiwana szerokosc symbolu: " << symbolBits << "\n";
+        return;
+    }
+
+    // otwieramy plik do odczytu w trybie binarnym
+    std::ifstream in(inputFile, std::ios::binary);
+    if (!in.is_open()) {
+        std::cerr << "Nie mozna otworzyc pliku wejsciowego: " << inputFile << "\n";
+        return;
+    }
+
+    int alphabetSize = 1 << symbolBits;
+    long long* freq = new long long[alphabetSize]();
+    long long totalBytes = 0;
+    bool hasTail = false;          // czy zostal nieparzysty ostatni bajt (tylko 16 bitow)
+    unsigned char tailByte = 0;    // ten ostatni bajt
+
+    // sumy kontrolne blokow tak jak w zwyklej kompresji
+    ChecksumList checksums;
+
+    {
+        // zliczanie symboli blokami z czytnikiem w tle
+        AsyncReader reader(in);
+        unsigned char* block = new unsigned char[CHECKSUM_BLOCK_SIZE];
+        int n;
+        while ((n = reader.read(block, CHECKSUM_BLOCK_SIZE)) > 0) {
+            countBlock(block, n, symbolBits, freq);
+            totalBytes += n;
+            // niepelny blok jest zawsze ostatni wiec nieparzysty bajt to koniec pliku
+            if (symbolBits == 16 && (n & 1)) {
+                hasTail = true;
+                tailByte = block[n - 1];
+            }
+            checksums.addBlock(block, n);
+        }
+        delete[] block;
+    }
+    in.clear();
+    in.seekg(0);
+
+    long long symbolCount = totalBytes / (symbolBits / 8);
+    if (totalBytes == 0) {
+        std::cout << "Plik jest pusty.\n";
+        delete[] freq;
+        return;
+    }
+
+    int usedSymbols = 0;
+    for (int s = 0; s < alphabetSize; s++) {
+        if (freq[s] > 0) usedSymbols++;
+    }
+    std::cout << "Wczytano " << symbolCount << " symboli " << symbolBits << "-bitowych ("
+              << usedSymbols << " roznych). Budowanie kodow...\n";
+
+    // dlugosci i kody kanoniczne indeksowane bezposrednio symbolem
+    unsigned char* lengths = new unsigned char[alphabetSize];
+    unsigned int* codes = new unsigned int[alphabetSize];
+    buildCodeLengths(freq, alphabetSize, lengths);
+    buildCanonicalCodes(lengths, alphabetSize, codes);
+
+    std::ofstream out(outputFile, std::ios::binary);
+
+    // naglowek binarny
+    out.write(WIDE_MAGIC, 4);
+    writeU8(out, symbolBits);
+    writeU8(out, hasTail ? 1 : 0);
+    writeU8(out, tailByte);
+    writeU64(out, (unsigned long long)symbolCount);
+    writeU32(out, CHECKSUM_BLOCK_SIZE);
+    writeU32(out, checksums.count);
+    for (int i = 0; i < checksums.count; i++) writeU32(out, checksums.values[i]);
+
+    // rzadki slownik tylko uzyte symbole jako odstep od poprzedniego i dlugosc kodu
+    writeU32(out, usedSymbols);
+    int previous = -1;
+    for (int s = 0; s < alphabetSize; s++) {
+        if (lengths[s]) {
+            writeVarint(out, s - previous - 1);
+            writeU8(out, lengths[s]);
+            previous = s;
+        }
+    }
+
+    {
+        // kodowanie w potoku czytnik koder pisarz
+        AsyncReader reader(in);
+        AsyncWriter writer(out);
+        WideBitWriter bw(writer);
+        unsigned char* block = new unsigned char[CHECKSUM_BLOCK_SIZE];
+        int n;
+        while ((n = reader.read(block, CHECKSUM_BLOCK_SIZE)) > 0) {
+            if (symbolBits == 8) {
+                for (int i = 0; i < n; i++) {
+                    bw.write(codes[block[i]], lengths[block[i]]);
+                }
+            } else {
+                for (int i = 0; i + 1 < n; i += 2) {
+                    int s = block[i] | (block[i + 1] << 8);
+                    bw.write(codes[s], lengths[s]);
+                }
+            }
+        }
+        bw.flush();
+        delete[] block;
+
+        if (!writer.finish()) {
+            std::cerr << "Blad zapisu do pliku: " << outputFile << "\n";
+            delete[] freq;
+            delete[] lengths;
+            delete[] codes;
+            return;
+        }
+    }
+
+    std::cout << "Kompresja zakonczona. Zapisano do " << outputFile << "\n";
+
+    delete[] freq;
+    delete[] lengths;
+    delete[] codes;
+}
+
+bool decodeFileWide(std::ifstream& in, const std::string& outputFile, bool verifyOnly) {
+    // sprawdzamy znacznik i parametry naglowka
+    char magic[4];
+    unsigned int symbolBits, hasTail, tailByte, blockSize, checksumCount;
+    unsigned long long symbolCount;
+    if (!in.read(magic, 4) || magic[0] != WIDE_MAGIC[0] || magic[1] != WIDE_MAGIC[1] ||
+        magic[2] != WIDE_MAGIC[2] || magic[3] != WIDE_MAGIC[3] ||
+        !readU8(in, symbolBits) || !readU8(in, hasTail) || !readU8(in, tailByte) ||
+        !readU64(in, symbolCount) || !readU32(in, blockSize) || !readU32(in, checksumCount)) {
+        std::cerr << "Blad odczytu naglowka (HUFW).\n";
+        return false;
+    }
+    int bytesPerSymbol = symbolBits / 8;
+    if ((symbolBits != 8 && symbolBits != 16) || hasTail > 1 || (hasTail && symbolBits != 16) ||
+        blockSize == 0 || blockSize > (1u << 26) || blockSize % bytesPerSymbol != 0 ||
+        symbolCount > (1ULL << 60)) {
+        std::cerr << "Niepoprawne parametry naglowka (HUFW).\n";
+        return false;
+    }
+    long long totalBytes = (long long)symbolCount * bytesPerSymbol + hasTail;
+    if (checksumCount != (unsigned long long)((totalBytes + blockSize - 1) / blockSize)) {
+        std::cerr << "Liczba sum kontrolnych nie zgadza sie z rozmiarem pliku.\n";
+        return false;
+    }
+    // rozmiar wyniku pochodzi z naglowka wiec sumy sprawdzamy z reszta pliku
+    // zanim zaalokujemy tablice kazda suma zajmuje 4 bajty
+    if ((long long)checksumCount * 4 > remainingBytes(in)) {
+        std::cerr << "Liczba sum kontrolnych wieksza niz rozmiar pliku.\n";
+        return false;
+    }
+
+    unsigned int* checksums = new unsigned int[checksumCount > 0 ? checksumCount : 1];
+    for (unsigned int i = 0; i < checksumCount; i++) {
+        if (!readU32(in, checksums[i])) {
+            std::cerr << "Blad odczytu sum kontrolnych.\n";
+            delete[] checksums;
+            return false;
+        }
+    }
+
+    // odczyt rzadkiego slownika
+    int alphabetSize = 1 << symbolBits;
+    unsigned char* lengths = new unsigned char[alphabetSize]();
+    unsigned int* codes = new unsigned int[alphabetSize];
+    unsigned int usedSymbols;
+    bool ok = readU32(in, usedSymbols) && usedSymbols <= (unsigned int)alphabetSize &&
+              (usedSymbols > 0 || symbolCount == 0);
+    long long kraft = 0; // suma krafta w jednostkach 2^-WIDE_MAX_CODE_LENGTH
+    int previous = -1;
+    for (unsigned int i = 0; ok && i < usedSymbols; i++) {
+        unsigned int delta, len;
+        if (!readVarint(in, delta) || !readU8(in, len) || delta >= (unsigned int)alphabetSize ||
+            previous + 1 + (long long)delta >= alphabetSize || len == 0 || len > WIDE_MAX_CODE_LENGTH) {
+            ok = false;
+            break;
+        }
+        previous += 1 + delta;
+        lengths[previous] = (unsigned char)len;
+        kraft += 1LL << (WIDE_MAX_CODE_LENGTH - len);
+    }
+    // kody ktore sie nie mieszcza nie moga byc prefiksowe
+    if (!ok || kraft > (1LL << WIDE_MAX_CODE_LENGTH)) {
+        std::cerr << "Blad odczytu slownika (HUFW).\n";
+        delete[] checksums;
+        delete[] lengths;
+        delete[] codes;
+        return false;
+    }
+
+    // kazdy symbol to co najmniej jeden bit danych
+    // wiec za duza liczba symboli oznacza urwany albo uszkodzony plik
+    if (symbolCount > (unsigned long long)remainingBytes(in) * 8) {
+        std::cerr << "Nieoczekiwany koniec pliku!\n";
+        delete[] checksums;
+        delete[] lengths;
+        delete[] codes;
+        return false;
+    }
+
+    std::cout << "Odtwarzanie kodow (" << usedSymbols << " symboli " << symbolBits << "-bitowych)...\n";
+    buildCanonicalCodes(lengths, alphabetSize, codes);
+    WideDecodeTable table;
+    table.build(lengths, codes, alphabetSize);
+    delete[] lengths;
+    delete[] codes;
+
+    // odkodowane bajty trafiaja do odbiornika ktory sprawdza sume kazdego bloku
+    // przed zapisem a w trybie testu nic nie zapisuje
+    CheckedBlockSink sink(outputFile, verifyOnly, checksums, blockSize, totalBytes);
+    AsyncReader reader(in);
+    WideBitReader br(reader);
+
+    std::cout << (verifyOnly ? "Weryfikacja tresci...\n" : "Dekodowanie tresci...\n");
+
+    const int P = WIDE_PRIMARY_BITS;
+    unsigned long long decoded = 0;
+    while (ok && decoded < symbolCount) {
+        if (br.bits < WIDE_MAX_CODE_LENGTH) br.refill();
+        // najpierw pierwsza tablica a jak to odnosnik to podtablica
+        unsigned int entry = table.primary[br.acc >> (64 - P)];
+        if (entry & WIDE_LINK_FLAG) {
+            int sub = (entry >> 24) & 31;
+            entry = table.secondary[(entry & 0xFFFFFF) + (unsigned int)((br.acc << P) >> (64 - sub))];
+        }
+        int len = (entry >> 16) & 31;
+        if (len == 0) {
+            std::cerr << "Blad struktury kodu!\n";
+            ok = false;
+            break;
+        }
+        br.consume(len);
+        // dekoder nie moze zuzyc bitow dopisanych po koncu pliku
+        if (br.usedBits > br.realBits) {
+            std::cerr << "Nieoczekiwany koniec pliku!\n";
+            ok = false;
+            break;
+        }
+
+        ok = sink.put((unsigned char)entry);
+        if (ok && bytesPerSymbol == 2) ok = sink.put((unsigned char)(entry >> 8));
+        decoded++;
+    }
+    // nieparzysty ostatni bajt nie byl kodowany
+    if (ok && hasTail) ok = sink.put((unsigned char)tailByte);
+    // sprawdzamy ostatni niepelny blok i czekamy az pisarz zapisze wszystko
+    if (ok) ok = sink.finish();
+
+    delete[] checksums;
+    return ok;
+}
@@ -0,0 +1,28 @@
+#ifndef HUFFMAN_WIDE_H
+#define HUFFMAN_WIDE_H
+
+#include <fstream>
+#include <string>
+
+// kodek huffmana dla szerokiego alfabetu
+// symbolem moze byc bajt (8 bitow) albo para bajtow little endian (16 bitow)
+// czyli do 65536 roznych symboli np probki z czujnikow albo tokeny
+// zamiast drzewa i kodow jako tekst uzywa kodow kanonicznych
+// dlugosci kodow sa liczone w miejscu na posortowanej tablicy czestosci
+// i ograniczone do WIDE_MAX_CODE_LENGTH bitow
+// dekoder korzysta z dwupoziomowych tablic zamiast chodzenia po drzewie
+
+// najdluzszy dozwolony kod w bitach
+const int WIDE_MAX_CODE_LENGTH = 20;
+// ile bitow obsluguje pierwsza tablica dekodera (2^11 wpisow po 4 bajty)
+const int WIDE_PRIMARY_BITS = 11;
+
+// kompresja pliku symbolami o szerokosci symbolBits (8 albo 16)
+void compressFileWide(const std::string& inputFile, const std::string& outputFile, int symbolBits);
+
+// dekodowanie pliku w formacie szerokim
+// strumien musi stac na poczatku pliku (na znaczniku HUFW)
+// jak verifyOnly jest true to tylko sprawdzamy sumy kontrolne bez zapisu
+bool decodeFileWide(std::ifstream& in, const std::string& outputFile, bool verifyOnly);
+
+#endif
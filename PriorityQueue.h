@@ -146,7 +146,13 @@ public:
         if (currentSize <= 0) throw std::runtime_error("Queue is empty");
         return heapArray[0].data; // zwracamy korzen
     }
-    
+
+    // podglad priorytetu elementu na wierzchu bez usuwania
+    int peekPriority() const {
+        if (currentSize <= 0) throw std::runtime_error("Queue is empty");
+        return heapArray[0].priority; // priorytet korzenia
+    }
+
     // pomocnicza funkcja sprawdzajaca czy sa elementy
     bool hasElements() const {
         return currentSize > 0;
@@ -0,0 +1,222 @@
+#ifndef RADIX_HEAP_H
+#define RADIX_HEAP_H
+
+#include <iostream>
+#include <stdexcept>
+#include "PriorityQueue.h"
+
+// kolejka priorytetowa typu radix heap
+// dziala tylko gdy wyciagane priorytety nie maleja czyli sa monotoniczne
+// tak jest np w algorytmie dijkstry albo przy kolejce zdarzen czasowych
+// ma ten sam interfejs co MinPriorityQueue ale zamiast porownan i zamian
+// wrzuca elementy do kubelkow wedlug najstarszego bitu ktorym klucz
+// rozni sie od ostatnio wyjetego minimum
+template <typename T>
+class RadixPriorityQueue {
+private:
+    // kubelek 0 trzyma klucze rowne ostatniemu minimum
+    // kubelek i trzyma klucze ktore roznia sie na bicie i-1 jako najstarszym
+    static const int BUCKET_COUNT = 33;
+
+    // pojedynczy kubelek czyli prosta tablica dynamiczna
+    struct Bucket {
+        HeapNode<T>* items; // elementy w kubelku
+        int size;           // ile jest elementow
+        int capacity;       // pojemnosc tablicy
+    };
+
+    Bucket buckets[BUCKET_COUNT]; // wszystkie kubelki
+    unsigned int last;            // klucz ostatnio wyjetego minimum
+    int currentSize;              // ile jest elementow w calej kolejce
+
+    // zamiana priorytetu int na klucz bez znaku z zachowaniem porzadku
+    // dzieki temu ujemne priorytety tez dzialaja
+    static unsigned int toKey(int priority) {
+        return (unsigned int)priority ^ 0x80000000u;
+    }
+
+    // numer kubelka dla danego klucza
+    int bucketIndex(unsigned int key) const {
+        if (key == last) return 0;
+        unsigned int diff = key ^ last; // bity ktorymi sie roznia
+#if defined(__GNUC__) || defined(__clang__)
+        return 32 - __builtin_clz(diff); // pozycja najstarszego bitu plus 1
+#else
+        int index = 0;
+        while (diff) {
+            diff >>= 1;
+            index++;
+        }
+        return index;
+#endif
+    }
+
+    // dodanie elementu na koniec kubelka
+    void pushToBucket(int index, const HeapNode<T>& node) {
+        Bucket& b = buckets[index];
+        // jak brakuje miejsca to powiekszamy 2 razy
+        if (b.size == b.capacity) {
+            int newCapacity = b.capacity == 0 ? 4 : b.capacity * 2;
+            HeapNode<T>* newItems = new HeapNode<T>[newCapacity];
+            for (int i = 0; i < b.size; i++) {
+                newItems[i] = b.items[i];
+            }
+            delete[] b.items;
+            b.items = newItems;
+            b.capacity = newCapacity;
+        }
+        b.items[b.size++] = node;
+    }
+
+    // jak kubelek 0 jest pusty to bierzemy pierwszy niepusty kubelek
+    // jego minimum staje sie nowym last a reszte rozrzucamy do nizszych kubelkow
+    // kazdy element moze spadac tylko w dol wiec koszt jest zamortyzowany
+    void refill() {
+        if (buckets[0].size > 0) return;
+        int i = 1;
+        while (buckets[i].size == 0) i++; // szukamy niepustego kubelka
+
+        Bucket& b = buckets[i];
+        // szukamy najmniejszego klucza w kubelku
+        unsigned int minKey = toKey(b.items[0].priority);
+        for (int j = 1; j < b.size; j++) {
+            unsigned int key = toKey(b.items[j].priority);
+            if (key < minKey) minKey = key;
+        }
+        last = minKey; // nowe minimum
+
+        // rozrzucamy elementy do kubelkow o mniejszych numerach
+        int count = b.size;
+        b.size = 0;
+        for (int j = 0; j < count; j++) {
+            pushToBucket(bucketIndex(toKey(b.items[j].priority)), b.items[j]);
+        }
+    }
+
+public:
+    // konstruktor parametr jest tylko dla zgodnosci z MinPriorityQueue
+    RadixPriorityQueue(int initialCapacity = 10) {
+        (void)initialCapacity; // kubelki rosna same
+        for (int i = 0; i < BUCKET_COUNT; i++) {
+            buckets[i].items = nullptr;
+            buckets[i].size = 0;
+            buckets[i].capacity = 0;
+        }
+        last = 0; // najmniejszy mozliwy klucz
+        currentSize = 0;
+    }
+
+    // destruktor czyszczacy pamiec wszystkich kubelkow
+    ~RadixPriorityQueue() {
+        for (int i = 0; i < BUCKET_COUNT; i++) {
+            delete[] buckets[i].items;
+        }
+    }
+
+    // sprawdza czy kolejka jest pusta
+    bool isEmpty() const {
+        return currentSize == 0;
+    }
+
+    // zwraca aktualna liczbe elementow
+    int size() const {
+        return currentSize;
+    }
+
+    // funkcja dodajaca nowy element
+    // priorytet nie moze byc mniejszy od ostatnio wyjetego minimum
+    void insert(T data, int priority) {
+        unsigned int key = toKey(priority);
+        if (key < last) {
+            throw std::runtime_error("Priority is below last extracted minimum");
+        }
+        pushToBucket(bucketIndex(key), {data, priority});
+        currentSize++;
+    }
+
+    // funkcja pobierajaca element o najmniejszym priorytecie
+    T extractMin() {
+        if (currentSize <= 0) {
+            throw std::runtime_error("Queue is empty");
+        }
+        refill(); // upewniamy sie ze minimum jest w kubelku 0
+        currentSize--;
+        return buckets[0].items[--buckets[0].size].data;
+    }
+
+    // podglad minimum bez usuwania
+    // nie jest const bo moze przerzucic elementy miedzy kubelkami
+    T peek() {
+        if (currentSize <= 0) throw std::runtime_error("Queue is empty");
+        refill();
+        return buckets[0].items[buckets[0].size - 1].data;
+    }
+
+    // pomocnicza funkcja sprawdzajaca czy sa elementy
+    bool hasElements() const {
+        return currentSize > 0;
+    }
+
+    // funkcja zmieniajaca priorytet istniejacego elementu
+    // tak jak w MinPriorityQueue element szukamy liniowo
+    // nowy priorytet nie moze byc mniejszy od ostatnio wyjetego minimum
+    bool decreaseKey(T targetData, int newPriority) {
+        for (int i = 0; i < BUCKET_COUNT; i++) {
+            Bucket& b = buckets[i];
+            for (int j = 0; j < b.size; j++) {
+                if (b.items[j].data == targetData) { // znalezlismy
+                    if (newPriority > b.items[j].priority || toKey(newPriority) < last) {
+                        return false; // nowy priorytet jest gorszy albo lamie monotonicznosc
+                    }
+                    HeapNode<T> node = b.items[j];
+                    node.priority = newPriority;
+                    b.items[j] = b.items[--b.size]; // usuwamy wstawiajac ostatni na jego miejsce
+                    pushToBucket(bucketIndex(toKey(newPriority)), node); // i wkladamy do nowego kubelka
+                    return true;
+                }
+            }
+        }
+        return false; // nie znalezlismy elementu
+    }
+
+    // funkcja budujaca kolejke z gotowej tablicy
+    // tak jak w MinPriorityQueue stara zawartosc jest zastepowana
+    // wiec najpierw czyscimy kubelki i wracamy do najmniejszego klucza
+    // a potem wstawiamy po kolei bo w radix heap wstawianie jest O 1
+    void build(T* data, int* priorities, int count) {
+        for (int i = 0; i < BUCKET_COUNT; i++) {
+            buckets[i].size = 0; // pamiec kubelkow zostaje do ponownego uzycia
+        }
+        last = 0;
+        currentSize = 0;
+        for (int i = 0; i < count; i++) {
+            insert(data[i], priorities[i]);
+        }
+    }
+
+    // funkcja wypisujaca zawartosc kolejki do konsoli kubelek po kubelku
+    void printQueue() {
+        std::cout << "Kolejka radix (rozmiar " << currentSize << "): ";
+        for (int i = 0; i < BUCKET_COUNT; i++) {
+            for (int j = 0; j < buckets[i].size; j++) {
+                std::cout << "[" << buckets[i].items[j].data << ":" << buckets[i].items[j].priority << "] ";
+            }
+        }
+        std::cout << "\n";
+    }
+};
+
+// wybor implementacji kolejki parametrem szablonu
+// SelectPriorityQueue<T, false>::type to zwykly kopiec
+// SelectPriorityQueue<T, true>::type to radix heap dla monotonicznych priorytetow
+template <typename T, bool Monotone>
+struct SelectPriorityQueue {
+    typedef MinPriorityQueue<T> type;
+};
+
+template <typename T>
+struct SelectPriorityQueue<T, true> {
+    typedef RadixPriorityQueue<T> type;
+};
+
+#endif
@@ -1,7 +1,12 @@
 #include <iostream>
 #include <string>
+#include <chrono>
 #include "Huffman.h"
+#include "HuffmanWide.h"
 #include "PriorityQueue.h"
+#include "RadixHeap.h"
+#include "Graph.h"
+#include "ExternalPriorityQueue.h"
 
 // funkcja obslugujaca menu dla kolejki priorytetowej
 // pozwala uzytkownikowi bawic sie kolejka
@@ -109,6 +114,21 @@ void runHuffmanCompression() {
     compressFile(inFile, outFile);
 }
 
+// funkcja pomocnicza do kompresji z szerokim alfabetem
+void runHuffmanWideCompression() {
+    std::string inFile, outFile;
+    int symbolBits;
+    std::cout << "Podaj nazwe pliku do kompresji (np. dane.bin): ";
+    std::cin >> inFile;
+    std::cout << "Podaj nazwe pliku wyjsciowego (np. skompresowany.bin): ";
+    std::cin >> outFile;
+    std::cout << "Podaj szerokosc symbolu w bitach (8 lub 16): ";
+    std::cin >> symbolBits;
+
+    // dekompresja rozpoznaje ten format sama wiec wystarczy opcja 3
+    compressFileWide(inFile, outFile, symbolBits);
+}
+
 // funkcja pomocnicza do uruchamiania dekompresji
 void runHuffmanDecompression() {
     std::string inFile, outFile;
@@ -121,6 +141,110 @@ void runHuffmanDecompression() {
     decompressFile(inFile, outFile);
 }
 
+// funkcja pomocnicza do uruchamiania testu archiwum
+void runHuffmanVerify() {
+    std::string inFile;
+    std::cout << "Podaj nazwe pliku do sprawdzenia (np. skompresowany.bin): ";
+    std::cin >> inFile;
+
+    // dekodujemy i sprawdzamy sumy kontrolne bez zapisu wyniku
+    verifyFile(inFile);
+}
+
+// benchmark porownujacy kopiec i radix heap na algorytmie dijkstry
+// oba przebiegi licza odleglosci na tym samym losowym grafie
+void runDijkstraBenchmark() {
+    int n, degree;
+    std::cout << "Podaj liczbe wierzcholkow (np. 1000000): ";
+    std::cin >> n;
+    std::cout << "Podaj liczbe krawedzi z kazdego wierzcholka (np. 8): ";
+    std::cin >> degree;
+    // wagi do 1000 wiec odleglosci musza sie miescic w int
+    if (n <= 1 || degree <= 0 || n > 2000000 || (long long)n * degree > 100000000) {
+        std::cout << "Niepoprawne parametry.\n";
+        return;
+    }
+
+    std::cout << "Generowanie grafu...\n";
+    Graph* g = generateRandomGraph(n, degree, 1000, 12345);
+    int* distHeap = new int[n];
+    int* distRadix = new int[n];
+
+    // przebieg na zwyklym kopcu
+    auto start = std::chrono::steady_clock::now();
+    dijkstra<false>(*g, 0, distHeap);
+    auto mid = std::chrono::steady_clock::now();
+    // przebieg na radix heap
+    dijkstra<true>(*g, 0, distRadix);
+    auto end = std::chrono::steady_clock::now();
+
+    // oba wyniki musza byc identyczne
+    bool same = true;
+    for (int v = 0; v < n; v++) {
+        if (distHeap[v] != distRadix[v]) {
+            same = false;
+            break;
+        }
+    }
+
+    std::chrono::duration<double, std::milli> heapTime = mid - start;
+    std::chrono::duration<double, std::milli> radixTime = end - mid;
+    std::cout << "MinPriorityQueue:   " << heapTime.count() << " ms\n";
+    std::cout << "RadixPriorityQueue: " << radixTime.count() << " ms\n";
+    std::cout << (same ? "Wyniki zgodne.\n" : "BLAD: wyniki sie roznia!\n");
+
+    delete[] distHeap;
+    delete[] distRadix;
+    deleteGraph(g);
+}
+
+// test kolejki zewnetrznej z malym limitem pamieci
+// wstawiamy losowe liczby wyciagamy wszystkie i sprawdzamy kolejnosc
+void runExternalQueueTest() {
+    long long n;
+    int budgetKb;
+    std::cout << "Podaj liczbe elementow (np. 10000000): ";
+    std::cin >> n;
+    std::cout << "Podaj limit pamieci w KB (np. 1024): ";
+    std::cin >> budgetKb;
+    if (n <= 0 || budgetKb <= 0) {
+        std::cout << "Niepoprawne parametry.\n";
+        return;
+    }
+
+    try {
+        ExternalMinPriorityQueue<int> pq((long long)budgetKb * 1024);
+        unsigned int state = 12345; // prosty generator xorshift
+
+        auto start = std::chrono::steady_clock::now();
+        for (long long i = 0; i < n; i++) {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            int prio = (int)(state & 0x7FFFFFFF);
+            pq.insert(prio, prio);
+        }
+        std::cout << "Wstawiono " << pq.size() << " elementow, zapisow na dysk: " << pq.spillCount()
+                  << ", przebiegow: " << pq.runCount() << "\n";
+
+        // wyciagamy wszystko i sprawdzamy czy wychodzi rosnaco
+        bool sorted = true;
+        int previous = -1;
+        while (!pq.isEmpty()) {
+            int value = pq.extractMin();
+            if (value < previous) sorted = false;
+            previous = value;
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        std::chrono::duration<double, std::milli> time = end - start;
+        std::cout << "Czas: " << time.count() << " ms\n";
+        std::cout << (sorted ? "Kolejnosc poprawna.\n" : "BLAD: zla kolejnosc!\n");
+    } catch (const std::exception& e) {
+        std::cout << "Blad: " << e.what() << "\n";
+    }
+}
+
 // glowna funkcja programu main
 int main() {
     // glowna petla programu
@@ -130,6 +254,10 @@ int main() {
         std::cout << "1. Testowanie Kolejki Priorytetowej (Min-Heap)\n";
         std::cout << "2. Kompresja pliku (Huffman)\n";
         std::cout << "3. Dekompresja pliku (Huffman)\n";
+        std::cout << "4. Weryfikacja pliku skompresowanego (test CRC32C)\n";
+        std::cout << "5. Benchmark Dijkstry (Min-Heap vs Radix Heap)\n";
+        std::cout << "6. Test kolejki zewnetrznej (przebiegi na dysku)\n";
+        std::cout << "7. Kompresja pliku z szerokim alfabetem (Huffman 8/16 bit)\n";
         std::cout << "0. Wyjscie\n";
         std::cout << "Wybierz opcje: ";
 
@@ -152,6 +280,18 @@ int main() {
             case 3:
                 runHuffmanDecompression(); // idziemy do dekompresji
                 break;
+            case 4:
+                runHuffmanVerify(); // idziemy do weryfikacji
+                break;
+            case 5:
+                runDijkstraBenchmark(); // idziemy do benchmarku
+                break;
+            case 6:
+                runExternalQueueTest(); // idziemy do testu kolejki zewnetrznej
+                break;
+            case 7:
+                runHuffmanWideCompression(); // idziemy do kompresji z szerokim alfabetem
+                break;
             case 0:
                 std::cout << "Koniec programu.\n"; // konczymy
                 return 0;